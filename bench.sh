@@ -0,0 +1,68 @@
+#!/bin/bash
+
+# Compares the throughput of the cache-sim build variants
+#
+# Usage: ./bench.sh "cache-sim cache-sim-release ..." trace1.txt [trace2.txt ...]
+#
+# The first variant is the baseline that speedups are measured against. Each variant's output is checked against the
+# baseline's (and against correct_outputs/<trace>_output.txt when it exists) so a faster build can't hide a wrong one.
+# Set RUNS to change how many times each variant is run per trace (the fastest run is reported).
+
+variants=($1)
+shift
+
+if [ ${#variants[@]} -eq 0 ] || [ $# -eq 0 ]; then
+    echo "Usage: $0 \"<variants>\" <trace> [<trace> ...]" >&2
+    exit 1
+fi
+
+runs=${RUNS:-3}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+status=0
+
+printf "%-20s %-20s %10s %14s %8s  %s\n" "variant" "trace" "seconds" "accesses/s" "speedup" "output"
+
+for trace in "$@"; do
+    accesses=$(wc -l < "$trace")
+    name=$(basename "$trace" .txt)
+    expected="correct_outputs/${name}_output.txt"
+    baseline=""
+
+    for variant in "${variants[@]}"; do
+        best=""
+
+        for ((i = 0; i < runs; i++)); do
+            start=$(date +%s%N)
+            "./$variant" "$trace" "$tmp/$variant.txt" || exit 1
+            end=$(date +%s%N)
+
+            elapsed=$((end - start))
+
+            if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+                best=$elapsed
+            fi
+        done
+
+        if [ -z "$baseline" ]; then
+            baseline=$best
+            reference="$tmp/$variant.txt"
+        fi
+
+        result="ok"
+
+        if ! cmp -s "$tmp/$variant.txt" "$reference"; then
+            result="MISMATCH (vs ${variants[0]})"
+            status=1
+        elif [ -f "$expected" ] && ! cmp -s "$tmp/$variant.txt" "$expected"; then
+            result="MISMATCH (vs $expected)"
+            status=1
+        fi
+
+        awk -v v="$variant" -v t="$name" -v ns="$best" -v n="$accesses" -v base="$baseline" -v r="$result" \
+            'BEGIN { printf "%-20s %-20s %10.3f %14.0f %7.2fx  %s\n", v, t, ns / 1e9, n / (ns / 1e9), base / ns, r }'
+    done
+done
+
+exit $status